@@ -311,6 +311,7 @@ path. Add it with -I<path> to the command line
 //  V8_HAS_BUILTIN_EXPECT               - __builtin_expect() supported
 //  V8_HAS_BUILTIN_FRAME_ADDRESS        - __builtin_frame_address() supported
 //  V8_HAS_BUILTIN_POPCOUNT             - __builtin_popcount() supported
+//  V8_HAS_BUILTIN_PREFETCH             - __builtin_prefetch() supported
 //  V8_HAS_BUILTIN_ADD_OVERFLOW         - __builtin_add_overflow() supported
 //  V8_HAS_BUILTIN_SUB_OVERFLOW         - __builtin_sub_overflow() supported
 //  V8_HAS_BUILTIN_MUL_OVERFLOW         - __builtin_mul_overflow() supported
@@ -383,6 +384,7 @@ path. Add it with -I<path> to the command line
 # define V8_HAS_BUILTIN_EXPECT (__has_builtin(__builtin_expect))
 # define V8_HAS_BUILTIN_FRAME_ADDRESS (__has_builtin(__builtin_frame_address))
 # define V8_HAS_BUILTIN_POPCOUNT (__has_builtin(__builtin_popcount))
+# define V8_HAS_BUILTIN_PREFETCH (__has_builtin(__builtin_prefetch))
 # define V8_HAS_BUILTIN_ADD_OVERFLOW (__has_builtin(__builtin_add_overflow))
 # define V8_HAS_BUILTIN_SUB_OVERFLOW (__has_builtin(__builtin_sub_overflow))
 # define V8_HAS_BUILTIN_MUL_OVERFLOW (__has_builtin(__builtin_mul_overflow))
@@ -430,6 +432,7 @@ path. Add it with -I<path> to the command line
 # define V8_HAS_BUILTIN_EXPECT 1
 # define V8_HAS_BUILTIN_FRAME_ADDRESS 1
 # define V8_HAS_BUILTIN_POPCOUNT 1
+# define V8_HAS_BUILTIN_PREFETCH 1
 # define V8_HAS_BUILTIN_UNREACHABLE 1
 
 // GCC doc: https://gcc.gnu.org/onlinedocs/gcc/Labels-as-Values.html
@@ -484,6 +487,21 @@ path. Add it with -I<path> to the command line
 #endif
 
 
+// Hints to the compiler that the data at the given address should be
+// prefetched into the cache ahead of its use. No-op where unsupported.
+// Use like:
+//   V8_PREFETCH_FOR_READ(address);
+#if V8_HAS_BUILTIN_PREFETCH
+# define V8_PREFETCH_FOR_READ(addr) \
+  __builtin_prefetch(reinterpret_cast<const void*>(addr), 0)
+# define V8_PREFETCH_FOR_WRITE(addr) \
+  __builtin_prefetch(reinterpret_cast<const void*>(addr), 1)
+#else
+# define V8_PREFETCH_FOR_READ(addr) static_cast<void>(addr)
+# define V8_PREFETCH_FOR_WRITE(addr) static_cast<void>(addr)
+#endif
+
+
 // A macro to mark functions whose values don't change (e.g. across calls)
 // and thereby compiler is free to hoist and fold multiple calls together.
 // Use like:
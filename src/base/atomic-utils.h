@@ -12,6 +12,7 @@
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
+#include "src/base/platform/yield-processor.h"
 
 namespace v8 {
 namespace base {
@@ -162,7 +163,12 @@ class AsAtomicImpl {
       new_value = (old_value & ~mask) | bits;
       old_value_before_cas = old_value;
       old_value = Release_CompareAndSwap(addr, old_value, new_value);
-    } while (old_value != old_value_before_cas);
+      if (old_value == old_value_before_cas) break;
+      // Another thread updated the same word, e.g. a neighboring mark bit in
+      // a shared bitmap cell. Back off before retrying with the fresh value
+      // so the cache line is not hammered while it ping-pongs between cores.
+      YIELD_PROCESSOR;
+    } while (true);
     return true;
   }
 
@@ -9,26 +9,48 @@
 #include "src/execution/isolate.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
+#include "src/heap/marking-inl.h"
 #include "src/heap/marking-state-inl.h"
 #include "src/objects/descriptor-array.h"
+#include "src/objects/instance-type-inl.h"
 
 namespace v8 {
 namespace internal {
 
-void IncrementalMarking::TransferColor(HeapObject from, HeapObject to) {
-  if (marking_state()->IsMarked(to)) {
-    DCHECK(black_allocation());
-    return;
-  }
-  DCHECK(marking_state()->IsUnmarked(to));
-  if (marking_state()->IsMarked(from)) {
-    bool success = marking_state()->TryMark(to);
-    DCHECK(success);
-    USE(success);
-    if (!to.IsDescriptorArray() ||
+V8_INLINE void IncrementalMarking::TransferColor(HeapObject from,
+                                                 HeapObject to) {
+  // Derive `to`'s chunk once up front; both the mark-bitmap cell prefetch and
+  // the live-byte accounting below are based on the same page mask.
+  MemoryChunk* to_chunk = MemoryChunk::FromHeapObject(to);
+  // `to` was typically just evacuated; neither its mark-bitmap cell nor its
+  // map word are likely to be in cache yet. Start fetching them while the
+  // probe of `from`'s mark bit resolves.
+  V8_PREFETCH_FOR_WRITE(
+      to_chunk->marking_bitmap()->cells() +
+      MarkingBitmap::IndexToCell(MarkingBitmap::AddressToIndex(to.ptr())));
+  V8_PREFETCH_FOR_READ(to.ptr());
+  // An already-marked target can only be the result of black allocation. This
+  // is verified with a single debug-only probe here; the release path relies
+  // solely on the CAS in TryMark() below.
+  DCHECK_IMPLIES(marking_state()->IsMarked(to), black_allocation());
+  if (V8_UNLIKELY(!marking_state()->IsMarked(from))) return;
+  // TryMark() fails iff the mark bit is already set, so the separate
+  // IsMarked(to) probe is fused into the mark CAS itself; the only way `to`
+  // can already be marked here is black allocation.
+  if (V8_LIKELY(marking_state()->TryMark(to))) {
+    // Whether live bytes may be credited right away is a property of the
+    // instance type: only DescriptorArray defers accounting to its
+    // raw_gc_state. Load the instance type once so the common case is a
+    // single range check followed by a straight increment.
+    const InstanceType instance_type = to.map().instance_type();
+    if (V8_LIKELY(!InstanceTypeChecker::IsDescriptorArray(instance_type)) ||
         (DescriptorArrayMarkingState::Marked::decode(
              DescriptorArray::cast(to).raw_gc_state(kRelaxedLoad)) != 0)) {
-      MemoryChunk::FromHeapObject(to)->IncrementLiveBytesAtomically(
+      // Credit the live bytes immediately: during scavenges `to` may sit on a
+      // new-space page whose liveness is cleared and whose chunk may be freed
+      // before the deferred background_live_bytes_ buffer is next flushed, so
+      // buffering the delta here would write through a stale chunk pointer.
+      to_chunk->IncrementLiveBytesAtomically(
           ALIGN_TO_ALLOCATION_ALIGNMENT(to.Size()));
     }
   }
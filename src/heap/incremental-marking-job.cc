@@ -4,6 +4,7 @@
 
 #include "src/heap/incremental-marking-job.h"
 
+#include "src/base/optional.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
 #include "src/execution/isolate.h"
@@ -22,6 +23,15 @@
 
 namespace v8::internal {
 
+namespace {
+// Overall budget for advancing marking within a single task invocation when
+// no task delay is configured. Each step is further bounded by
+// IncrementalMarking's own per-step limit; re-arming in place avoids a
+// platform task-queue round trip per slice.
+constexpr v8::base::TimeDelta kMaxTimeInTask =
+    v8::base::TimeDelta::FromMilliseconds(2);
+}  // namespace
+
 class IncrementalMarkingJob::Task final : public CancelableTask {
  public:
   Task(Isolate* isolate, IncrementalMarkingJob* job, StackState stack_state)
@@ -44,44 +54,56 @@ class IncrementalMarkingJob::Task final : public CancelableTask {
 IncrementalMarkingJob::IncrementalMarkingJob(Heap* heap)
     : heap_(heap),
       foreground_task_runner_(V8::GetCurrentPlatform()->GetForegroundTaskRunner(
-          reinterpret_cast<v8::Isolate*>(heap->isolate()))) {
+          reinterpret_cast<v8::Isolate*>(heap->isolate()))),
+      non_nestable_tasks_enabled_(
+          foreground_task_runner_->NonNestableTasksEnabled()),
+      task_delay_in_seconds_(v8::base::TimeDelta::FromMilliseconds(
+                                 v8_flags.incremental_marking_task_delay_ms)
+                                 .InSecondsF()) {
   CHECK(v8_flags.incremental_marking_task);
 }
 
 void IncrementalMarkingJob::ScheduleTask(TaskType task_type) {
+  // When a task is already pending - the common case under allocation
+  // pressure, where many threads race to schedule marking - reject the
+  // request without touching the mutex.
+  uint8_t expected = kNoTaskPending;
+  if (!pending_task_.compare_exchange_strong(expected, Encode(task_type),
+                                             std::memory_order_acq_rel)) {
+    return;
+  }
+
   base::MutexGuard guard(&mutex_);
 
-  if (pending_task_.has_value() || heap_->IsTearingDown()) {
+  if (V8_UNLIKELY(heap_->IsTearingDown())) {
+    pending_task_.store(kNoTaskPending, std::memory_order_release);
     return;
   }
 
-  const bool non_nestable_tasks_enabled =
-      foreground_task_runner_->NonNestableTasksEnabled();
+  // The task is allocated fresh per slice by design: TaskRunner takes
+  // ownership through std::unique_ptr<v8::Task> and destroys the task with
+  // the default deleter on an arbitrary platform thread, so the storage
+  // cannot be recycled from a job-owned pool.
   auto task = std::make_unique<Task>(heap_->isolate(), this,
-                                     non_nestable_tasks_enabled
+                                     non_nestable_tasks_enabled_
                                          ? StackState::kNoHeapPointers
                                          : StackState::kMayContainHeapPointers);
-  if (non_nestable_tasks_enabled) {
-    if (task_type == TaskType::kNormal) {
+  if (task_type == TaskType::kNormal) {
+    if (non_nestable_tasks_enabled_) {
       foreground_task_runner_->PostNonNestableTask(std::move(task));
     } else {
-      foreground_task_runner_->PostNonNestableDelayedTask(
-          std::move(task), v8::base::TimeDelta::FromMilliseconds(
-                               v8_flags.incremental_marking_task_delay_ms)
-                               .InSecondsF());
+      foreground_task_runner_->PostTask(std::move(task));
     }
   } else {
-    if (task_type == TaskType::kNormal) {
-      foreground_task_runner_->PostTask(std::move(task));
+    if (non_nestable_tasks_enabled_) {
+      foreground_task_runner_->PostNonNestableDelayedTask(
+          std::move(task), task_delay_in_seconds_);
     } else {
-      foreground_task_runner_->PostDelayedTask(
-          std::move(task), v8::base::TimeDelta::FromMilliseconds(
-                               v8_flags.incremental_marking_task_delay_ms)
-                               .InSecondsF());
+      foreground_task_runner_->PostDelayedTask(std::move(task),
+                                               task_delay_in_seconds_);
     }
   }
 
-  pending_task_.emplace(task_type);
   scheduled_time_ = v8::base::TimeTicks::Now();
   if (V8_UNLIKELY(v8_flags.trace_incremental_marking)) {
     heap_->isolate()->PrintWithTimestamp(
@@ -96,13 +118,7 @@ void IncrementalMarkingJob::Task::RunInternal() {
   isolate()->stack_guard()->ClearStartIncrementalMarking();
 
   Heap* heap = isolate()->heap();
-
-  {
-    base::MutexGuard guard(&job_->mutex_);
-    heap->tracer()->RecordTimeToIncrementalMarkingTask(
-        (v8::base::TimeTicks::Now() - job_->scheduled_time_).InMillisecondsF());
-    job_->scheduled_time_ = v8::base::TimeTicks();
-  }
+  const auto task_start_time = v8::base::TimeTicks::Now();
 
   EmbedderStackStateScope scope(
       heap, EmbedderStackStateScope::kImplicitThroughTask, stack_state_);
@@ -120,33 +136,47 @@ void IncrementalMarkingJob::Task::RunInternal() {
   }
 
   // Clear this flag after StartIncrementalMarking() call to avoid scheduling a
-  // new task when starting incremental marking from a task.
+  // new task when starting incremental marking from a task. Recording the
+  // time-to-task here as well keeps this the only mutex_ acquisition per run;
+  // scheduled_time_ cannot change concurrently while pending_task_ is set.
   {
     base::MutexGuard guard(&job_->mutex_);
+    heap->tracer()->RecordTimeToIncrementalMarkingTask(
+        (task_start_time - job_->scheduled_time_).InMillisecondsF());
+    job_->scheduled_time_ = v8::base::TimeTicks();
     if (V8_UNLIKELY(v8_flags.trace_incremental_marking)) {
       job_->heap_->isolate()->PrintWithTimestamp(
           "[IncrementalMarking] Job: Run (%s)\n",
-          ToString(job_->pending_task_.value()));
+          ToString(Decode(
+              job_->pending_task_.load(std::memory_order_relaxed))));
     }
-    job_->pending_task_.reset();
+    job_->pending_task_.store(kNoTaskPending, std::memory_order_release);
   }
 
   if (incremental_marking->IsMajorMarking()) {
-    heap->incremental_marking()->AdvanceAndFinalizeIfComplete();
-    if (incremental_marking->IsMajorMarking()) {
-      TaskType task_type;
-      if (v8_flags.incremental_marking_task_delay_ms > 0) {
-        task_type = heap->incremental_marking()->IsAheadOfSchedule()
-                        ? TaskType::kPending
-                        : TaskType::kNormal;
-      } else {
-        task_type = TaskType::kNormal;
+    if (v8_flags.incremental_marking_task_delay_ms > 0) {
+      heap->incremental_marking()->AdvanceAndFinalizeIfComplete();
+      if (incremental_marking->IsMajorMarking()) {
+        job_->ScheduleTask(incremental_marking->IsAheadOfSchedule()
+                               ? TaskType::kPending
+                               : TaskType::kNormal);
+      }
+    } else {
+      // Without a task delay, re-posting would run a fresh task per slice.
+      // Keep advancing in place while there is budget left and only go back
+      // through the platform queue once it is used up.
+      const auto deadline = v8::base::TimeTicks::Now() + kMaxTimeInTask;
+      do {
+        heap->incremental_marking()->AdvanceAndFinalizeIfComplete();
+      } while (incremental_marking->IsMajorMarking() &&
+               v8::base::TimeTicks::Now() < deadline);
+      if (incremental_marking->IsMajorMarking()) {
         if (V8_UNLIKELY(v8_flags.trace_incremental_marking)) {
           isolate()->PrintWithTimestamp(
               "[IncrementalMarking] Using regular task based on flags\n");
         }
+        job_->ScheduleTask(TaskType::kNormal);
       }
-      job_->ScheduleTask(task_type);
     }
   }
 }
@@ -155,11 +185,16 @@ base::Optional<v8::base::TimeDelta> IncrementalMarkingJob::AverageTimeToTask()
     const {
   const double recorded_time_to_task =
       heap_->tracer()->AverageTimeToIncrementalMarkingTask();
+  const uint8_t pending_task = pending_task_.load(std::memory_order_acquire);
+  const bool has_pending_task = pending_task != kNoTaskPending;
+  // Don't sample the clock at all when there is neither a task in flight nor
+  // recorded history; this is the common case on the allocation slow path.
+  if (!has_pending_task && recorded_time_to_task == 0.0) return {};
   base::Optional<double> current_time_to_task;
-  if (pending_task_.has_value()) {
+  if (has_pending_task) {
     const double delta_ms =
         (v8::base::TimeTicks::Now() - scheduled_time_).InMillisecondsF();
-    if (pending_task_.value() == TaskType::kNormal) {
+    if (Decode(pending_task) == TaskType::kNormal) {
       current_time_to_task.emplace(delta_ms);
     } else {
       const double delayed_delta_ms =
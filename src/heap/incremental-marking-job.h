@@ -5,10 +5,14 @@
 #ifndef V8_HEAP_INCREMENTAL_MARKING_JOB_H_
 #define V8_HEAP_INCREMENTAL_MARKING_JOB_H_
 
+#include <atomic>
+#include <cstdint>
+
 #include "include/v8-platform.h"
 #include "src/base/optional.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
+#include "src/common/globals.h"
 
 namespace v8::internal {
 
@@ -42,14 +46,38 @@ class IncrementalMarkingJob final {
  private:
   class Task;
 
+  // Sentinel for "no task pending". The pending task's type and its presence
+  // are packed into a single atomic so that both the lock-free fast path in
+  // ScheduleTask() and readers such as AverageTimeToTask() need one load.
+  static constexpr uint8_t kNoTaskPending = 0;
+
+  static constexpr uint8_t Encode(TaskType task_type) {
+    return static_cast<uint8_t>(task_type) + 1;
+  }
+
+  static constexpr TaskType Decode(uint8_t encoded) {
+    return static_cast<TaskType>(encoded - 1);
+  }
+
   Heap* const heap_;
   const std::shared_ptr<v8::TaskRunner> foreground_task_runner_;
-  mutable base::Mutex mutex_;
+  // Effectively constant over the lifetime of the job; cached to avoid a
+  // virtual dispatch and a flag-to-seconds conversion per schedule.
+  const bool non_nestable_tasks_enabled_;
+  const double task_delay_in_seconds_;
+  // The pending-task sentinel is polled lock-free by many mutator threads.
+  // Keep it on its own cache line so those reads do not contend with the
+  // mutex and timestamp written when tasks are scheduled and run.
+  alignas(PROCESSOR_CACHE_LINE_SIZE) std::atomic<uint8_t> pending_task_{
+      kNoTaskPending};
+  alignas(PROCESSOR_CACHE_LINE_SIZE) mutable base::Mutex mutex_;
   v8::base::TimeTicks scheduled_time_;
-  base::Optional<TaskType> pending_task_;
 };
 
-constexpr const char* ToString(IncrementalMarkingJob::TaskType task_type) {
+// Only used on --trace-incremental-marking paths; keep it out of line so the
+// switch does not get inlined into the hot scheduling and task-run code.
+V8_NOINLINE inline const char* ToString(
+    IncrementalMarkingJob::TaskType task_type) {
   switch (task_type) {
     case IncrementalMarkingJob::TaskType::kNormal:
       return "normal";
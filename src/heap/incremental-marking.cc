@@ -100,9 +100,25 @@ IncrementalMarking::IncrementalMarking(Heap* heap, WeakObjects* weak_objects)
 
 void IncrementalMarking::MarkBlackBackground(HeapObject obj, int object_size) {
   CHECK(marking_state()->TryMark(obj));
+  AddLiveBytes(MemoryChunk::FromHeapObject(obj),
+               static_cast<intptr_t>(object_size));
+}
+
+void IncrementalMarking::AddLiveBytes(MemoryChunk* chunk, intptr_t live_bytes) {
   base::MutexGuard guard(&background_live_bytes_mutex_);
-  background_live_bytes_[MemoryChunk::FromHeapObject(obj)] +=
-      static_cast<intptr_t>(object_size);
+  background_live_bytes_[chunk] += live_bytes;
+}
+
+void IncrementalMarking::FlushLiveBytes() {
+  base::MutexGuard guard(&background_live_bytes_mutex_);
+  for (const auto& pair : background_live_bytes_) {
+    MemoryChunk* memory_chunk = pair.first;
+    intptr_t live_bytes = pair.second;
+    if (live_bytes) {
+      memory_chunk->IncrementLiveBytesAtomically(live_bytes);
+    }
+  }
+  background_live_bytes_.clear();
 }
 
 bool IncrementalMarking::CanBeStarted() const {
@@ -600,14 +616,7 @@ bool IncrementalMarking::Stop() {
   FinishBlackAllocation();
 
   // Merge live bytes counters of background threads
-  for (const auto& pair : background_live_bytes_) {
-    MemoryChunk* memory_chunk = pair.first;
-    intptr_t live_bytes = pair.second;
-    if (live_bytes) {
-      memory_chunk->IncrementLiveBytesAtomically(live_bytes);
-    }
-  }
-  background_live_bytes_.clear();
+  FlushLiveBytes();
   schedule_.reset();
 
   return true;
@@ -717,6 +726,7 @@ size_t IncrementalMarking::GetScheduledBytes(StepOrigin step_origin) {
 }
 
 void IncrementalMarking::AdvanceAndFinalizeIfComplete() {
+  FlushLiveBytes();
   const size_t max_bytes_to_process = GetScheduledBytes(StepOrigin::kTask);
   Step(kMaxStepSizeOnTask, max_bytes_to_process, StepOrigin::kTask);
   if (IsMajorMarkingComplete()) {
@@ -192,6 +192,16 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
 
   void RequestMinorGCFinalizationIfNeeded();
 
+  // Accumulates live bytes for `chunk` in a per-chunk delta buffer instead of
+  // performing an atomic RMW on the chunk's counter for every object. The
+  // deltas are only applied on task slices and when marking stops, so this
+  // must not be used for chunks whose live bytes may be reset or that may be
+  // released before then, e.g. new-space pages between scavenges.
+  void AddLiveBytes(MemoryChunk* chunk, intptr_t live_bytes);
+  // Flushes the accumulated deltas with a single atomic update per touched
+  // chunk.
+  void FlushLiveBytes();
+
   MarkingState* marking_state() { return marking_state_; }
   MarkingWorklists::Local* local_marking_worklists() const {
     return current_local_marking_worklists_;
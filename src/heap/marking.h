@@ -17,6 +17,13 @@ namespace v8::internal {
 
 class Page;
 
+// A single mark bit within a page's MarkingBitmap. Mark bits are packed one
+// bit per tagged word, so atomic updates operate on whole bitmap cells and
+// concurrent markers may contend on a cell shared by neighboring objects.
+// This is a deliberate trade-off: a byte-per-object mark array would avoid
+// that false sharing but costs 8x the memory and is incompatible with the
+// cell-based range operations (black allocation, live object iteration)
+// below.
 class MarkBit final {
  public:
   using CellType = uintptr_t;
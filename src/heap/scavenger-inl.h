@@ -109,6 +109,9 @@ bool Scavenger::MigrateObject(Map map, HeapObject source, HeapObject target,
 
   if (is_incremental_marking_ &&
       (promotion_heap_choice != kPromoteIntoSharedHeap || mark_shared_heap_)) {
+    // The color must be transferred eagerly: the concurrent marker may
+    // observe `target` through an updated slot right after the forwarding CAS
+    // above, so the mark bit cannot be deferred into a batched buffer.
     heap()->incremental_marking()->TransferColor(source, target);
   }
   pretenuring_handler_->UpdateAllocationSite(map, source,
@@ -4,6 +4,9 @@
 
 #include "src/objects/ordered-hash-table.h"
 
+#include <algorithm>
+
+#include "src/base/small-vector.h"
 #include "src/execution/isolate.h"
 #include "src/heap/heap-inl.h"
 #include "src/objects/internal-index.h"
@@ -37,9 +40,10 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Allocate(
   Handle<Derived> table = Handle<Derived>::cast(backing_store);
   DisallowGarbageCollection no_gc;
   Tagged<Derived> raw_table = *table;
-  for (int i = 0; i < num_buckets; ++i) {
-    raw_table->set(HashTableStartIndex() + i, Smi::FromInt(kNotFound));
-  }
+  // The bucket heads are all Smis, so the whole region can be filled with a
+  // single pass instead of one write-barriered store per bucket.
+  MemsetTagged(raw_table->RawFieldOfElementAt(HashTableStartIndex()),
+               Smi::FromInt(kNotFound), num_buckets);
   raw_table->SetNumberOfBuckets(num_buckets);
   raw_table->SetNumberOfElements(0);
   raw_table->SetNumberOfDeletedElements(0);
@@ -109,6 +113,14 @@ Handle<Derived> OrderedHashTable<Derived, entrysize>::Clear(
     Isolate* isolate, Handle<Derived> table) {
   DCHECK(!table->IsObsolete());
 
+  // A pristine table of initial size has nothing to clear. Reusing it skips
+  // the allocation and is safe for iterators: without the obsolescence
+  // transition they keep observing the same, still-empty table.
+  if (table->NumberOfElements() == 0 && table->NumberOfDeletedElements() == 0 &&
+      table->NumberOfBuckets() == kInitialCapacity / kLoadFactor) {
+    return table;
+  }
+
   AllocationType allocation_type = Heap::InYoungGeneration(*table)
                                        ? AllocationType::kYoung
                                        : AllocationType::kOld;
@@ -158,11 +170,27 @@ InternalIndex OrderedHashTable<Derived, entrysize>::FindEntry(Isolate* isolate,
     raw_entry = HashToEntryRaw(Smi::ToInt(hash));
   }
 
-  // Walk the chain in the bucket to find the key.
+  // Walk the chain in the bucket to find the key. The data-table start is
+  // loop-invariant; computing it once keeps the bucket count from being
+  // reloaded on every hop.
+  const int data_start = HashTableStartIndex() + NumberOfBuckets();
   while (raw_entry != kNotFound) {
-    Object candidate_key = KeyAt(InternalIndex(raw_entry));
-    if (candidate_key.SameValueZero(key)) return InternalIndex(raw_entry);
-    raw_entry = NextChainEntryRaw(raw_entry);
+    Object candidate_key = get(data_start + (raw_entry * kEntrySize));
+    // Pointer equality implies SameValueZero and covers Smi keys as well as
+    // identical heap objects, so the type-dispatching comparison only runs
+    // when the fast check misses.
+    if (candidate_key == key || candidate_key.SameValueZero(key)) {
+      return InternalIndex(raw_entry);
+    }
+    raw_entry = NextChainEntryRaw(raw_entry, data_start);
+    if (raw_entry != kNotFound) {
+      // Start fetching the next candidate's key while the comparison result
+      // above is still being retired; chain hops are data-dependent loads
+      // that would otherwise serialize.
+      V8_PREFETCH_FOR_READ(
+          RawFieldOfElementAt(data_start + (raw_entry * kEntrySize))
+              .address());
+    }
   }
 
   return InternalIndex::NotFound();
@@ -171,35 +199,49 @@ InternalIndex OrderedHashTable<Derived, entrysize>::FindEntry(Isolate* isolate,
 MaybeHandle<OrderedHashSet> OrderedHashSet::Add(Isolate* isolate,
                                                 Handle<OrderedHashSet> table,
                                                 Handle<Object> key) {
-  int hash;
+  int hash = key->GetOrCreateHash(isolate).value();
+  return Add(isolate, table, key, hash);
+}
+
+MaybeHandle<OrderedHashSet> OrderedHashSet::Add(Isolate* isolate,
+                                                Handle<OrderedHashSet> table,
+                                                Handle<Object> key, int hash) {
+  int bucket = kNotFound;
+  int previous_entry = kNotFound;
+  bool table_has_room = false;
   {
     DisallowGarbageCollection no_gc;
     Tagged<Object> raw_key = *key;
     Tagged<OrderedHashSet> raw_table = *table;
-    hash = raw_key->GetOrCreateHash(isolate).value();
-    if (raw_table->NumberOfElements() > 0) {
-      int raw_entry = raw_table->HashToEntryRaw(hash);
-      // Walk the chain of the bucket and try finding the key.
-      while (raw_entry != kNotFound) {
-        Object candidate_key = raw_table->KeyAt(InternalIndex(raw_entry));
-        // Do not add if we have the key already
-        if (candidate_key.SameValueZero(raw_key)) return table;
-        raw_entry = raw_table->NextChainEntryRaw(raw_entry);
-      }
+    DCHECK_EQ(hash, Smi::ToInt(raw_key->GetHash()));
+    if (raw_table->NumberOfBuckets() > 0) {
+      bucket = raw_table->HashToBucket(hash);
+      // Walk the chain of the bucket once, both to reject duplicates and to
+      // pick up the chain head for the insertion below.
+      auto [raw_entry, head] = raw_table->FindEntryAndHeadRaw(raw_key, hash);
+      if (raw_entry != kNotFound) return table;
+      previous_entry = head;
+      // If the table has room left, EnsureCapacityForAdding would return it
+      // unchanged, so the bucket and chain head recorded above stay valid.
+      table_has_room = raw_table->UsedCapacity() < raw_table->Capacity();
     }
   }
 
-  MaybeHandle<OrderedHashSet> table_candidate =
-      OrderedHashSet::EnsureCapacityForAdding(isolate, table);
-  if (!table_candidate.ToHandle(&table)) {
-    CHECK(isolate->has_pending_exception());
-    return table_candidate;
+  if (!table_has_room) {
+    MaybeHandle<OrderedHashSet> table_candidate =
+        OrderedHashSet::EnsureCapacityForAdding(isolate, table);
+    if (!table_candidate.ToHandle(&table)) {
+      CHECK(isolate->has_pending_exception());
+      return table_candidate;
+    }
   }
   DisallowGarbageCollection no_gc;
   Tagged<OrderedHashSet> raw_table = *table;
-  // Read the existing bucket values.
-  int bucket = raw_table->HashToBucket(hash);
-  int previous_entry = raw_table->HashToEntryRaw(hash);
+  if (!table_has_room) {
+    // The table was grown or compacted; re-read the bucket values.
+    bucket = raw_table->HashToBucket(hash);
+    previous_entry = raw_table->HashToEntryRaw(hash);
+  }
   int nof = raw_table->NumberOfElements();
   // Insert a new entry at the end,
   int new_entry = nof + raw_table->NumberOfDeletedElements();
@@ -212,6 +254,12 @@ MaybeHandle<OrderedHashSet> OrderedHashSet::Add(Isolate* isolate,
   return table;
 }
 
+void OrderedHashSet::AddNoResize(Object value, int hash) {
+  DisallowGarbageCollection no_gc;
+  DCHECK_EQ(hash, Smi::ToInt(value.GetHash()));
+  set(AddEntryRaw(hash), value);
+}
+
 Handle<FixedArray> OrderedHashSet::ConvertToKeysArray(
     Isolate* isolate, Handle<OrderedHashSet> table, GetKeysConversion convert) {
   int length = table->NumberOfElements();
@@ -222,8 +270,8 @@ Handle<FixedArray> OrderedHashSet::ConvertToKeysArray(
   result->set_map(ReadOnlyRoots(isolate).fixed_array_map());
   int const kMaxStringTableEntries =
       isolate->heap()->MaxNumberToStringCacheSize();
-  for (int i = 0; i < length; i++) {
-    int index = HashTableStartIndex() + nof_buckets + (i * kEntrySize);
+  int index = HashTableStartIndex() + nof_buckets;
+  for (int i = 0; i < length; i++, index += kEntrySize) {
     Object key = table->get(index);
     uint32_t index_value;
     if (convert == GetKeysConversion::kConvertToString) {
@@ -276,26 +324,47 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
 
   DisallowGarbageCollection no_gc;
 
+  // Both data tables start right behind the respective bucket regions; the
+  // old index additionally skips holes, so only the new one can be advanced
+  // by a fixed stride.
+  const int old_data_start = HashTableStartIndex() + table->NumberOfBuckets();
+  const int new_data_start = HashTableStartIndex() + new_buckets;
+  int new_index = new_data_start;
+
+  // Tracks the last entry appended to each new bucket so chains are extended
+  // at the tail without re-reading the bucket head on every entry. As a side
+  // effect chains end up in insertion order rather than reversed.
+  base::SmallVector<int, 64> bucket_tails(new_buckets);
+  std::fill(bucket_tails.begin(), bucket_tails.end(), kNotFound);
+
+  const Object the_hole = ReadOnlyRoots(isolate).the_hole_value();
   for (InternalIndex old_entry : table->IterateEntries()) {
     int old_entry_raw = old_entry.as_int();
     Object key = table->KeyAt(old_entry);
-    if (key.IsTheHole(isolate)) {
+    if (key == the_hole) {
       table->SetRemovedIndexAt(removed_holes_index++, old_entry_raw);
       continue;
     }
 
     Object hash = key.GetHash();
     int bucket = Smi::ToInt(hash) & (new_buckets - 1);
-    Object chain_entry = new_table->get(HashTableStartIndex() + bucket);
-    new_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
-    int new_index = new_table->EntryToIndexRaw(new_entry);
-    int old_index = table->EntryToIndexRaw(old_entry_raw);
-    for (int i = 0; i < entrysize; ++i) {
-      Object value = table->get(old_index + i);
-      new_table->set(new_index + i, value);
+    int old_index = old_data_start + old_entry_raw * kEntrySize;
+    // Copy the payload in one range operation so the write-barrier check is
+    // performed once per entry instead of once per slot.
+    new_table->CopyElements(isolate, new_index, *table, old_index, entrysize,
+                            UPDATE_WRITE_BARRIER);
+    const int tail = bucket_tails[bucket];
+    if (tail == kNotFound) {
+      new_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
+    } else {
+      new_table->set(new_data_start + tail * kEntrySize + kChainOffset,
+                     Smi::FromInt(new_entry));
     }
-    new_table->set(new_index + kChainOffset, chain_entry);
+    // The new entry is its bucket's tail until a later entry hashes there.
+    new_table->set(new_index + kChainOffset, Smi::FromInt(kNotFound));
+    bucket_tails[bucket] = new_entry;
     ++new_entry;
+    new_index += kEntrySize;
   }
 
   DCHECK_EQ(table->NumberOfDeletedElements(), removed_holes_index);
@@ -380,31 +449,45 @@ MaybeHandle<OrderedHashMap> OrderedHashMap::Add(Isolate* isolate,
                                                 Handle<Object> key,
                                                 Handle<Object> value) {
   int hash = key->GetOrCreateHash(isolate).value();
-  if (table->NumberOfElements() > 0) {
-    int raw_entry = table->HashToEntryRaw(hash);
-    // Walk the chain of the bucket and try finding the key.
-    {
-      DisallowGarbageCollection no_gc;
-      Object raw_key = *key;
-      while (raw_entry != kNotFound) {
-        Object candidate_key = table->KeyAt(InternalIndex(raw_entry));
-        // Do not add if we have the key already
-        if (candidate_key.SameValueZero(raw_key)) return table;
-        raw_entry = table->NextChainEntryRaw(raw_entry);
-      }
-    }
+  return Add(isolate, table, key, value, hash);
+}
+
+MaybeHandle<OrderedHashMap> OrderedHashMap::Add(Isolate* isolate,
+                                                Handle<OrderedHashMap> table,
+                                                Handle<Object> key,
+                                                Handle<Object> value,
+                                                int hash) {
+  DCHECK_EQ(hash, Smi::ToInt(key->GetHash()));
+  int bucket = kNotFound;
+  int previous_entry = kNotFound;
+  bool table_has_room = false;
+  if (table->NumberOfBuckets() > 0) {
+    DisallowGarbageCollection no_gc;
+    bucket = table->HashToBucket(hash);
+    // Walk the chain of the bucket once, both to reject duplicates and to
+    // pick up the chain head for the insertion below.
+    auto [raw_entry, head] = table->FindEntryAndHeadRaw(*key, hash);
+    if (raw_entry != kNotFound) return table;
+    previous_entry = head;
+    // If the table has room left, EnsureCapacityForAdding would return it
+    // unchanged, so the bucket and chain head recorded above stay valid.
+    table_has_room = table->UsedCapacity() < table->Capacity();
   }
 
-  MaybeHandle<OrderedHashMap> table_candidate =
-      OrderedHashMap::EnsureCapacityForAdding(isolate, table);
-  if (!table_candidate.ToHandle(&table)) {
-    return table_candidate;
+  if (!table_has_room) {
+    MaybeHandle<OrderedHashMap> table_candidate =
+        OrderedHashMap::EnsureCapacityForAdding(isolate, table);
+    if (!table_candidate.ToHandle(&table)) {
+      return table_candidate;
+    }
   }
   DisallowGarbageCollection no_gc;
   Tagged<OrderedHashMap> raw_table = *table;
-  // Read the existing bucket values.
-  int bucket = raw_table->HashToBucket(hash);
-  int previous_entry = raw_table->HashToEntryRaw(hash);
+  if (!table_has_room) {
+    // The table was grown or compacted; re-read the bucket values.
+    bucket = raw_table->HashToBucket(hash);
+    previous_entry = raw_table->HashToEntryRaw(hash);
+  }
   int nof = raw_table->NumberOfElements();
   // Insert a new entry at the end,
   int new_entry = nof + raw_table->NumberOfDeletedElements();
@@ -418,6 +501,14 @@ MaybeHandle<OrderedHashMap> OrderedHashMap::Add(Isolate* isolate,
   return table;
 }
 
+void OrderedHashMap::AddNoResize(Object key, Object value, int hash) {
+  DisallowGarbageCollection no_gc;
+  DCHECK_EQ(hash, Smi::ToInt(key.GetHash()));
+  int new_index = AddEntryRaw(hash);
+  set(new_index, key);
+  set(new_index + kValueOffset, value);
+}
+
 void OrderedHashMap::SetEntry(InternalIndex entry, Object key, Object value) {
   DisallowGarbageCollection no_gc;
   int index = EntryToIndex(entry);
@@ -439,17 +530,22 @@ InternalIndex OrderedNameDictionary::FindEntry(IsolateT* isolate, Object key) {
   }
 
   int raw_entry = HashToEntryRaw(raw_key.hash());
+  const int data_start = HashTableStartIndex() + NumberOfBuckets();
   while (raw_entry != kNotFound) {
     InternalIndex entry(raw_entry);
-    Object candidate_key = KeyAt(entry);
+    Object candidate_key = get(data_start + (raw_entry * kEntrySize));
     DCHECK(candidate_key.IsTheHole() ||
            Name::cast(candidate_key).IsUniqueName());
     if (candidate_key == raw_key) return entry;
 
-    // TODO(gsathya): This is loading the bucket count from the hash
-    // table for every iteration. This should be peeled out of the
-    // loop.
-    raw_entry = NextChainEntryRaw(raw_entry);
+    raw_entry = NextChainEntryRaw(raw_entry, data_start);
+    if (raw_entry != kNotFound) {
+      // Overlap the next hop's key load with the current comparison; see
+      // OrderedHashTable::FindEntry above.
+      V8_PREFETCH_FOR_READ(
+          RawFieldOfElementAt(data_start + (raw_entry * kEntrySize))
+              .address());
+    }
   }
 
   return InternalIndex::NotFound();
@@ -491,6 +587,16 @@ MaybeHandle<OrderedNameDictionary> OrderedNameDictionary::Add(
   return table;
 }
 
+void OrderedNameDictionary::AddNoResize(Name key, Object value,
+                                        PropertyDetails details) {
+  DisallowGarbageCollection no_gc;
+  DCHECK(key.IsUniqueName());
+  int new_index = AddEntryRaw(key.hash());
+  set(new_index, key);
+  set(new_index + kValueOffset, value);
+  set(new_index + kPropertyDetailsOffset, details.AsSmi());
+}
+
 void OrderedNameDictionary::SetEntry(InternalIndex entry, Object key,
                                      Object value, PropertyDetails details) {
   DisallowGarbageCollection gc;
@@ -665,18 +771,32 @@ void SmallOrderedHashTable<Derived>::Initialize(Isolate* isolate,
   SetNumberOfBuckets(num_buckets);
   SetNumberOfElements(0);
   SetNumberOfDeletedElements(0);
+  // Fill the regions in ascending address order - padding, data table,
+  // buckets and chains - so initialization makes one monotonic pass over the
+  // object instead of jumping behind the data table and back.
   memset(reinterpret_cast<void*>(field_address(PaddingOffset())), 0,
          PaddingSize());
 
+  MemsetTagged(RawField(DataTableStartOffset()),
+               ReadOnlyRoots(isolate).the_hole_value(),
+               capacity * Derived::kEntrySize);
+
   Address hashtable_start = GetHashTableStartAddress(capacity);
   memset(reinterpret_cast<uint8_t*>(hashtable_start), kNotFound,
          num_buckets + num_chains);
 
-  MemsetTagged(RawField(DataTableStartOffset()),
-               ReadOnlyRoots(isolate).the_hole_value(),
-               capacity * Derived::kEntrySize);
+#ifdef DEBUG
+  CheckInitialized(isolate, capacity);
+#endif  // DEBUG
+}
 
 #ifdef DEBUG
+template <class Derived>
+void SmallOrderedHashTable<Derived>::CheckInitialized(Isolate* isolate,
+                                                      int capacity) {
+  int num_buckets = capacity / kLoadFactor;
+  int num_chains = capacity;
+
   for (int i = 0; i < num_buckets; ++i) {
     DCHECK_EQ(kNotFound, GetFirstEntry(i));
   }
@@ -690,14 +810,14 @@ void SmallOrderedHashTable<Derived>::Initialize(Isolate* isolate,
       DCHECK_EQ(ReadOnlyRoots(isolate).the_hole_value(), GetDataEntry(i, j));
     }
   }
-#endif  // DEBUG
 }
+#endif  // DEBUG
 
 MaybeHandle<SmallOrderedHashSet> SmallOrderedHashSet::Add(
     Isolate* isolate, Handle<SmallOrderedHashSet> table, Handle<Object> key) {
   if (table->HasKey(isolate, key)) return table;
 
-  if (table->UsedCapacity() >= table->Capacity()) {
+  if (V8_UNLIKELY(table->UsedCapacity() >= table->Capacity())) {
     MaybeHandle<SmallOrderedHashSet> new_table =
         SmallOrderedHashSet::Grow(isolate, table);
     if (!new_table.ToHandle(&table)) {
@@ -710,9 +830,10 @@ MaybeHandle<SmallOrderedHashSet> SmallOrderedHashSet::Add(
   int hash = key->GetOrCreateHash(isolate).value();
   int nof = raw_table->NumberOfElements();
 
-  // Read the existing bucket values.
+  // Read the existing bucket values; the bucket is already known, so read
+  // the chain head directly instead of re-deriving it from the hash.
   int bucket = raw_table->HashToBucket(hash);
-  int previous_entry = raw_table->HashToFirstEntry(hash);
+  int previous_entry = raw_table->GetFirstEntry(bucket);
 
   // Insert a new entry at the end,
   int new_entry = nof + raw_table->NumberOfDeletedElements();
@@ -742,7 +863,7 @@ MaybeHandle<SmallOrderedHashMap> SmallOrderedHashMap::Add(
     Handle<Object> value) {
   if (table->HasKey(isolate, key)) return table;
 
-  if (table->UsedCapacity() >= table->Capacity()) {
+  if (V8_UNLIKELY(table->UsedCapacity() >= table->Capacity())) {
     MaybeHandle<SmallOrderedHashMap> new_table =
         SmallOrderedHashMap::Grow(isolate, table);
     if (!new_table.ToHandle(&table)) {
@@ -754,9 +875,10 @@ MaybeHandle<SmallOrderedHashMap> SmallOrderedHashMap::Add(
   int hash = key->GetOrCreateHash(isolate).value();
   int nof = raw_table->NumberOfElements();
 
-  // Read the existing bucket values.
+  // Read the existing bucket values; the bucket is already known, so read
+  // the chain head directly instead of re-deriving it from the hash.
   int bucket = raw_table->HashToBucket(hash);
-  int previous_entry = raw_table->HashToFirstEntry(hash);
+  int previous_entry = raw_table->GetFirstEntry(bucket);
 
   // Insert a new entry at the end,
   int new_entry = nof + raw_table->NumberOfDeletedElements();
@@ -798,6 +920,16 @@ SmallOrderedHashTable<SmallOrderedNameDictionary>::FindEntry(Isolate* isolate,
     Object candidate_key = KeyAt(entry);
     if (candidate_key == key) return entry;
     raw_entry = GetNextEntry(raw_entry);
+    if (raw_entry != kNotFound) {
+      // Chain hops are data-dependent loads; start fetching the next
+      // candidate's entry (key and details share it) while the current
+      // comparison retires.
+      V8_PREFETCH_FOR_READ(
+          RawField(
+              GetDataEntryOffset(raw_entry,
+                                 SmallOrderedNameDictionary::kKeyIndex))
+              .address());
+    }
   }
 
   return InternalIndex::NotFound();
@@ -809,7 +941,7 @@ MaybeHandle<SmallOrderedNameDictionary> SmallOrderedNameDictionary::Add(
   DCHECK(key->IsUniqueName());
   DCHECK(table->FindEntry(isolate, *key).is_not_found());
 
-  if (table->UsedCapacity() >= table->Capacity()) {
+  if (V8_UNLIKELY(table->UsedCapacity() >= table->Capacity())) {
     MaybeHandle<SmallOrderedNameDictionary> new_table =
         SmallOrderedNameDictionary::Grow(isolate, table);
     if (!new_table.ToHandle(&table)) {
@@ -819,10 +951,11 @@ MaybeHandle<SmallOrderedNameDictionary> SmallOrderedNameDictionary::Add(
 
   int nof = table->NumberOfElements();
 
-  // Read the existing bucket values.
+  // Read the existing bucket values; the bucket is already known, so read
+  // the chain head directly instead of re-deriving it from the hash.
   int hash = key->hash();
   int bucket = table->HashToBucket(hash);
-  int previous_entry = table->HashToFirstEntry(hash);
+  int previous_entry = table->GetFirstEntry(bucket);
 
   // Insert a new entry at the end,
   int new_entry = nof + table->NumberOfDeletedElements();
@@ -871,15 +1004,15 @@ bool SmallOrderedHashTable<Derived>::Delete(Isolate* isolate, Derived table,
                                             Object key) {
   DisallowGarbageCollection no_gc;
   InternalIndex entry = table.FindEntry(isolate, key);
-  if (entry.is_not_found()) return false;
+  if (V8_UNLIKELY(entry.is_not_found())) return false;
 
   int nof = table.NumberOfElements();
   int nod = table.NumberOfDeletedElements();
 
-  Object hole = ReadOnlyRoots(isolate).the_hole_value();
-  for (int j = 0; j < Derived::kEntrySize; j++) {
-    table.SetDataEntry(entry.as_int(), j, hole);
-  }
+  // The hole is a read-only immortal, so the whole entry can be cleared with
+  // one barrier-free fill instead of kEntrySize write-barriered stores.
+  MemsetTagged(table.RawField(table.GetDataEntryOffset(entry.as_int(), 0)),
+               ReadOnlyRoots(isolate).the_hole_value(), Derived::kEntrySize);
 
   table.SetNumberOfElements(nof - 1);
   table.SetNumberOfDeletedElements(nod + 1);
@@ -919,9 +1052,10 @@ Handle<Derived> SmallOrderedHashTable<Derived>::Rehash(Isolate* isolate,
 
   {
     DisallowGarbageCollection no_gc;
+    const Object the_hole = ReadOnlyRoots(isolate).the_hole_value();
     for (InternalIndex old_entry : table->IterateEntries()) {
       Object key = table->KeyAt(old_entry);
-      if (key.IsTheHole(isolate)) continue;
+      if (key == the_hole) continue;
 
       int hash = Smi::ToInt(key.GetHash());
       int bucket = new_table->HashToBucket(hash);
@@ -930,10 +1064,13 @@ Handle<Derived> SmallOrderedHashTable<Derived>::Rehash(Isolate* isolate,
       new_table->SetFirstEntry(bucket, new_entry);
       new_table->SetNextEntry(new_entry, chain);
 
-      for (int i = 0; i < Derived::kEntrySize; ++i) {
-        Object value = table->GetDataEntry(old_entry.as_int(), i);
-        new_table->SetDataEntry(new_entry, i, value);
-      }
+      // Copy the whole entry as one range so the write-barrier check is done
+      // once per entry rather than once per field.
+      isolate->heap()->CopyRange(
+          *new_table,
+          new_table->RawField(new_table->GetDataEntryOffset(new_entry, 0)),
+          table->RawField(table->GetDataEntryOffset(old_entry.as_int(), 0)),
+          Derived::kEntrySize, UPDATE_WRITE_BARRIER);
 
       ++new_entry;
     }
@@ -970,7 +1107,9 @@ Handle<Derived> SmallOrderedHashTable<Derived>::Shrink(Isolate* isolate,
                                                        Handle<Derived> table) {
   int nof = table->NumberOfElements();
   int capacity = table->Capacity();
-  if (nof >= (capacity >> 2)) return table;
+  // At the minimum capacity there is nothing to shrink to; rehashing would
+  // just allocate a same-size table.
+  if (nof >= (capacity >> 2) || capacity <= kMinCapacity) return table;
   return Derived::Rehash(isolate, table, capacity / 2);
 }
 
@@ -1007,15 +1146,23 @@ InternalIndex SmallOrderedHashTable<Derived>::FindEntry(Isolate* isolate,
   DisallowGarbageCollection no_gc;
   Object hash = key.GetHash();
 
-  if (hash.IsUndefined(isolate)) return InternalIndex::NotFound();
+  if (V8_UNLIKELY(hash.IsUndefined(isolate))) return InternalIndex::NotFound();
   int raw_entry = HashToFirstEntry(Smi::ToInt(hash));
 
   // Walk the chain in the bucket to find the key.
   while (raw_entry != kNotFound) {
     InternalIndex entry(raw_entry);
     Object candidate_key = KeyAt(entry);
-    if (candidate_key.SameValueZero(key)) return entry;
+    // Pointer equality implies SameValueZero and skips the type dispatch.
+    if (candidate_key == key || candidate_key.SameValueZero(key)) return entry;
     raw_entry = GetNextEntry(raw_entry);
+    if (raw_entry != kNotFound) {
+      // Overlap the next chain hop's load with the comparison above; the
+      // hops are data-dependent and would otherwise serialize.
+      V8_PREFETCH_FOR_READ(
+          RawField(GetDataEntryOffset(raw_entry, Derived::kKeyIndex))
+              .address());
+    }
   }
   return InternalIndex::NotFound();
 }
@@ -1092,7 +1239,7 @@ OrderedHashTableHandler<SmallOrderedNameDictionary,
 template <class SmallTable, class LargeTable>
 bool OrderedHashTableHandler<SmallTable, LargeTable>::Delete(
     Isolate* isolate, Handle<HeapObject> table, Handle<Object> key) {
-  if (SmallTable::Is(table)) {
+  if (V8_LIKELY(SmallTable::Is(table))) {
     return SmallTable::Delete(isolate, *Handle<SmallTable>::cast(table), *key);
   }
 
@@ -1105,7 +1252,7 @@ bool OrderedHashTableHandler<SmallTable, LargeTable>::Delete(
 template <class SmallTable, class LargeTable>
 bool OrderedHashTableHandler<SmallTable, LargeTable>::HasKey(
     Isolate* isolate, Handle<HeapObject> table, Handle<Object> key) {
-  if (SmallTable::Is(table)) {
+  if (V8_LIKELY(SmallTable::Is(table))) {
     return Handle<SmallTable>::cast(table)->HasKey(isolate, key);
   }
 
@@ -1141,22 +1288,23 @@ MaybeHandle<OrderedHashMap> OrderedHashMapHandler::AdjustRepresentation(
     return new_table_candidate;
   }
 
-  // TODO(gsathya): Optimize the lookup to not re calc offsets. Also,
-  // unhandlify this code as we preallocate the new backing store with
-  // the proper capacity.
-  for (InternalIndex entry : table->IterateEntries()) {
-    Handle<Object> key = handle(table->KeyAt(entry), isolate);
-    if (key->IsTheHole(isolate)) continue;
-    Handle<Object> value = handle(
-        table->GetDataEntry(entry.as_int(), SmallOrderedHashMap::kValueIndex),
-        isolate);
-    new_table_candidate = OrderedHashMap::Add(isolate, new_table, key, value);
-    if (!new_table_candidate.ToHandle(&new_table)) {
-      return new_table_candidate;
-    }
+  // The target table is preallocated and AddNoResize does not allocate, so
+  // the migration can run on raw objects without per-entry handles.
+  DisallowGarbageCollection no_gc;
+  Tagged<SmallOrderedHashMap> raw_source = *table;
+  Tagged<OrderedHashMap> raw_target = *new_table;
+  const Object the_hole = ReadOnlyRoots(isolate).the_hole_value();
+  for (InternalIndex entry : raw_source->IterateEntries()) {
+    Object key = raw_source->KeyAt(entry);
+    if (key == the_hole) continue;
+    Object value = raw_source->GetDataEntry(
+        entry.as_int(), SmallOrderedHashMap::kValueIndex);
+    // Keys were hashed when they entered the small table, and the new table
+    // has room for all of them, so insert directly.
+    raw_target->AddNoResize(key, value, Smi::ToInt(key.GetHash()));
   }
 
-  return new_table_candidate;
+  return new_table;
 }
 
 MaybeHandle<OrderedHashSet> OrderedHashSetHandler::AdjustRepresentation(
@@ -1168,19 +1316,21 @@ MaybeHandle<OrderedHashSet> OrderedHashSetHandler::AdjustRepresentation(
     return new_table_candidate;
   }
 
-  // TODO(gsathya): Optimize the lookup to not re calc offsets. Also,
-  // unhandlify this code as we preallocate the new backing store with
-  // the proper capacity.
-  for (InternalIndex entry : table->IterateEntries()) {
-    Handle<Object> key = handle(table->KeyAt(entry), isolate);
-    if (key->IsTheHole(isolate)) continue;
-    new_table_candidate = OrderedHashSet::Add(isolate, new_table, key);
-    if (!new_table_candidate.ToHandle(&new_table)) {
-      return new_table_candidate;
-    }
+  // The target table is preallocated and AddNoResize does not allocate, so
+  // the migration can run on raw objects without per-entry handles.
+  DisallowGarbageCollection no_gc;
+  Tagged<SmallOrderedHashSet> raw_source = *table;
+  Tagged<OrderedHashSet> raw_target = *new_table;
+  const Object the_hole = ReadOnlyRoots(isolate).the_hole_value();
+  for (InternalIndex entry : raw_source->IterateEntries()) {
+    Object key = raw_source->KeyAt(entry);
+    if (key == the_hole) continue;
+    // Keys were hashed when they entered the small table, and the new table
+    // has room for all of them, so insert directly.
+    raw_target->AddNoResize(key, Smi::ToInt(key.GetHash()));
   }
 
-  return new_table_candidate;
+  return new_table;
 }
 
 MaybeHandle<OrderedNameDictionary>
@@ -1193,29 +1343,28 @@ OrderedNameDictionaryHandler::AdjustRepresentation(
     return new_table_candidate;
   }
 
-  // TODO(gsathya): Optimize the lookup to not re calc offsets. Also,
-  // unhandlify this code as we preallocate the new backing store with
-  // the proper capacity.
-  for (InternalIndex entry : table->IterateEntries()) {
-    Handle<Name> key(Name::cast(table->KeyAt(entry)), isolate);
-    if (key->IsTheHole(isolate)) continue;
-    Handle<Object> value(table->ValueAt(entry), isolate);
-    PropertyDetails details = table->DetailsAt(entry);
-    new_table_candidate =
-        OrderedNameDictionary::Add(isolate, new_table, key, value, details);
-    if (!new_table_candidate.ToHandle(&new_table)) {
-      return new_table_candidate;
-    }
+  // The target table is preallocated and AddNoResize does not allocate, so
+  // the migration can run on raw objects without per-entry handles.
+  DisallowGarbageCollection no_gc;
+  Tagged<SmallOrderedNameDictionary> raw_source = *table;
+  Tagged<OrderedNameDictionary> raw_target = *new_table;
+  const Object the_hole = ReadOnlyRoots(isolate).the_hole_value();
+  for (InternalIndex entry : raw_source->IterateEntries()) {
+    Object key = raw_source->KeyAt(entry);
+    if (key == the_hole) continue;
+    Object value = raw_source->ValueAt(entry);
+    PropertyDetails details = raw_source->DetailsAt(entry);
+    raw_target->AddNoResize(Name::cast(key), value, details);
   }
 
-  return new_table_candidate;
+  return new_table;
 }
 
 MaybeHandle<HeapObject> OrderedHashMapHandler::Add(Isolate* isolate,
                                                    Handle<HeapObject> table,
                                                    Handle<Object> key,
                                                    Handle<Object> value) {
-  if (table->IsSmallOrderedHashMap()) {
+  if (V8_LIKELY(table->IsSmallOrderedHashMap())) {
     Handle<SmallOrderedHashMap> small_map =
         Handle<SmallOrderedHashMap>::cast(table);
     MaybeHandle<SmallOrderedHashMap> new_map =
@@ -1239,7 +1388,7 @@ MaybeHandle<HeapObject> OrderedHashMapHandler::Add(Isolate* isolate,
 MaybeHandle<HeapObject> OrderedHashSetHandler::Add(Isolate* isolate,
                                                    Handle<HeapObject> table,
                                                    Handle<Object> key) {
-  if (table->IsSmallOrderedHashSet()) {
+  if (V8_LIKELY(table->IsSmallOrderedHashSet())) {
     Handle<SmallOrderedHashSet> small_set =
         Handle<SmallOrderedHashSet>::cast(table);
     MaybeHandle<SmallOrderedHashSet> new_set =
@@ -1262,7 +1411,7 @@ MaybeHandle<HeapObject> OrderedHashSetHandler::Add(Isolate* isolate,
 MaybeHandle<HeapObject> OrderedNameDictionaryHandler::Add(
     Isolate* isolate, Handle<HeapObject> table, Handle<Name> key,
     Handle<Object> value, PropertyDetails details) {
-  if (table->IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table->IsSmallOrderedNameDictionary())) {
     Handle<SmallOrderedNameDictionary> small_dict =
         Handle<SmallOrderedNameDictionary>::cast(table);
     MaybeHandle<SmallOrderedNameDictionary> new_dict =
@@ -1289,7 +1438,7 @@ void OrderedNameDictionaryHandler::SetEntry(HeapObject table,
                                             Object value,
                                             PropertyDetails details) {
   DisallowGarbageCollection no_gc;
-  if (table.IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table.IsSmallOrderedNameDictionary())) {
     return SmallOrderedNameDictionary::cast(table).SetEntry(entry, key, value,
                                                             details);
   }
@@ -1303,7 +1452,7 @@ InternalIndex OrderedNameDictionaryHandler::FindEntry(Isolate* isolate,
                                                       HeapObject table,
                                                       Name key) {
   DisallowGarbageCollection no_gc;
-  if (table.IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table.IsSmallOrderedNameDictionary())) {
     return SmallOrderedNameDictionary::cast(table).FindEntry(isolate, key);
   }
 
@@ -1313,7 +1462,7 @@ InternalIndex OrderedNameDictionaryHandler::FindEntry(Isolate* isolate,
 
 Object OrderedNameDictionaryHandler::ValueAt(HeapObject table,
                                              InternalIndex entry) {
-  if (table.IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table.IsSmallOrderedNameDictionary())) {
     return SmallOrderedNameDictionary::cast(table).ValueAt(entry);
   }
 
@@ -1324,7 +1473,7 @@ Object OrderedNameDictionaryHandler::ValueAt(HeapObject table,
 void OrderedNameDictionaryHandler::ValueAtPut(HeapObject table,
                                               InternalIndex entry,
                                               Object value) {
-  if (table.IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table.IsSmallOrderedNameDictionary())) {
     return SmallOrderedNameDictionary::cast(table).ValueAtPut(entry, value);
   }
 
@@ -1334,7 +1483,7 @@ void OrderedNameDictionaryHandler::ValueAtPut(HeapObject table,
 
 PropertyDetails OrderedNameDictionaryHandler::DetailsAt(HeapObject table,
                                                         InternalIndex entry) {
-  if (table.IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table.IsSmallOrderedNameDictionary())) {
     return SmallOrderedNameDictionary::cast(table).DetailsAt(entry);
   }
 
@@ -1345,7 +1494,7 @@ PropertyDetails OrderedNameDictionaryHandler::DetailsAt(HeapObject table,
 void OrderedNameDictionaryHandler::DetailsAtPut(HeapObject table,
                                                 InternalIndex entry,
                                                 PropertyDetails details) {
-  if (table.IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table.IsSmallOrderedNameDictionary())) {
     return SmallOrderedNameDictionary::cast(table).DetailsAtPut(entry, details);
   }
 
@@ -1354,7 +1503,7 @@ void OrderedNameDictionaryHandler::DetailsAtPut(HeapObject table,
 }
 
 int OrderedNameDictionaryHandler::Hash(HeapObject table) {
-  if (table.IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table.IsSmallOrderedNameDictionary())) {
     return SmallOrderedNameDictionary::cast(table).Hash();
   }
 
@@ -1363,7 +1512,7 @@ int OrderedNameDictionaryHandler::Hash(HeapObject table) {
 }
 
 void OrderedNameDictionaryHandler::SetHash(HeapObject table, int hash) {
-  if (table.IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table.IsSmallOrderedNameDictionary())) {
     return SmallOrderedNameDictionary::cast(table).SetHash(hash);
   }
 
@@ -1373,7 +1522,7 @@ void OrderedNameDictionaryHandler::SetHash(HeapObject table, int hash) {
 
 Name OrderedNameDictionaryHandler::KeyAt(HeapObject table,
                                          InternalIndex entry) {
-  if (table.IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table.IsSmallOrderedNameDictionary())) {
     return Name::cast(SmallOrderedNameDictionary::cast(table).KeyAt(entry));
   }
 
@@ -1382,7 +1531,7 @@ Name OrderedNameDictionaryHandler::KeyAt(HeapObject table,
 }
 
 int OrderedNameDictionaryHandler::NumberOfElements(HeapObject table) {
-  if (table.IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table.IsSmallOrderedNameDictionary())) {
     return SmallOrderedNameDictionary::cast(table).NumberOfElements();
   }
 
@@ -1390,7 +1539,7 @@ int OrderedNameDictionaryHandler::NumberOfElements(HeapObject table) {
 }
 
 int OrderedNameDictionaryHandler::Capacity(HeapObject table) {
-  if (table.IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table.IsSmallOrderedNameDictionary())) {
     return SmallOrderedNameDictionary::cast(table).Capacity();
   }
 
@@ -1399,7 +1548,7 @@ int OrderedNameDictionaryHandler::Capacity(HeapObject table) {
 
 Handle<HeapObject> OrderedNameDictionaryHandler::Shrink(
     Isolate* isolate, Handle<HeapObject> table) {
-  if (table->IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table->IsSmallOrderedNameDictionary())) {
     Handle<SmallOrderedNameDictionary> small_dict =
         Handle<SmallOrderedNameDictionary>::cast(table);
     return SmallOrderedNameDictionary::Shrink(isolate, small_dict);
@@ -1413,7 +1562,7 @@ Handle<HeapObject> OrderedNameDictionaryHandler::Shrink(
 Handle<HeapObject> OrderedNameDictionaryHandler::DeleteEntry(
     Isolate* isolate, Handle<HeapObject> table, InternalIndex entry) {
   DisallowGarbageCollection no_gc;
-  if (table->IsSmallOrderedNameDictionary()) {
+  if (V8_LIKELY(table->IsSmallOrderedNameDictionary())) {
     Handle<SmallOrderedNameDictionary> small_dict =
         Handle<SmallOrderedNameDictionary>::cast(table);
     return SmallOrderedNameDictionary::DeleteEntry(isolate, small_dict, entry);
@@ -1442,12 +1591,21 @@ void OrderedHashTableIterator<Derived, TableType>::Transition() {
       if (nod == TableType::kClearedTableSentinel) {
         index = 0;
       } else {
+        // The removed indices were recorded in ascending entry order, so the
+        // number of removals below the old index - the amount the iterator
+        // position shifts down by - can be found with a binary search.
         int old_index = index;
-        for (int i = 0; i < nod; ++i) {
-          int removed_index = table.RemovedIndexAt(i);
-          if (removed_index >= old_index) break;
-          --index;
+        int lo = 0;
+        int hi = nod;
+        while (lo < hi) {
+          int mid = lo + ((hi - lo) >> 1);
+          if (table.RemovedIndexAt(mid) < old_index) {
+            lo = mid + 1;
+          } else {
+            hi = mid;
+          }
         }
+        index -= lo;
       }
     }
 
@@ -1469,8 +1627,9 @@ bool OrderedHashTableIterator<Derived, TableType>::HasMore() {
   int index = Smi::ToInt(this->index());
   int used_capacity = table.UsedCapacity();
 
+  const Object the_hole = ro_roots.the_hole_value();
   while (index < used_capacity &&
-         table.KeyAt(InternalIndex(index)).IsTheHole(ro_roots)) {
+         table.KeyAt(InternalIndex(index)) == the_hole) {
     index++;
   }
 
@@ -5,6 +5,8 @@
 #ifndef V8_OBJECTS_ORDERED_HASH_TABLE_H_
 #define V8_OBJECTS_ORDERED_HASH_TABLE_H_
 
+#include <utility>
+
 #include "src/base/export-template.h"
 #include "src/common/globals.h"
 #include "src/objects/fixed-array.h"
@@ -48,6 +50,12 @@ namespace internal {
 //                            into the data table indicating the next
 //                            entry in this hash bucket.
 //
+// This layout is not private to the C++ accessors below: the collection
+// builtins (builtins-collections-gen.cc) and the CodeStubAssembler walk it
+// through the same index constants from baked-in snapshot code. Any layout
+// change (e.g. splitting keys and chain links into separate regions) has to
+// be mirrored there.
+//
 // When we transition the table to a new version we obsolete it and reuse parts
 // of the memory to store information how to transition an iterator to the new
 // table:
@@ -221,13 +229,55 @@ class OrderedHashTable : public FixedArray {
   }
 
   int NextChainEntryRaw(int entry) {
+    return NextChainEntryRaw(entry, HashTableStartIndex() + NumberOfBuckets());
+  }
+
+  // Like the above, but takes the data-table start index precomputed by the
+  // caller, so chain walks do not reload the bucket count on every hop.
+  int NextChainEntryRaw(int entry, int data_start) {
     DCHECK_LT(entry, this->UsedCapacity());
-    Object next_entry = get(EntryToIndexRaw(entry) + kChainOffset);
+    DCHECK_EQ(data_start, HashTableStartIndex() + NumberOfBuckets());
+    Object next_entry = get(data_start + (entry * kEntrySize) + kChainOffset);
     int next_entry_int = Smi::ToInt(next_entry);
     DCHECK(next_entry_int == kNotFound || next_entry_int >= 0);
     return next_entry_int;
   }
 
+  // Walks the chain for |hash| once and returns both the entry matching
+  // |key| (kNotFound if absent) and the entry at the head of the bucket.
+  // This lets Add paths fuse their duplicate check with reading the
+  // insertion point instead of traversing the bucket twice.
+  std::pair<int, int> FindEntryAndHeadRaw(Object key, int hash) {
+    DCHECK_GT(NumberOfBuckets(), 0);
+    const int head = HashToEntryRaw(hash);
+    const int data_start = HashTableStartIndex() + NumberOfBuckets();
+    int raw_entry = head;
+    while (raw_entry != kNotFound) {
+      Object candidate_key = get(data_start + (raw_entry * kEntrySize));
+      // Pointer equality implies SameValueZero and skips the type dispatch.
+      if (candidate_key == key || candidate_key.SameValueZero(key)) break;
+      raw_entry = NextChainEntryRaw(raw_entry, data_start);
+    }
+    return {raw_entry, head};
+  }
+
+  // Links a fresh entry for |hash| into its bucket chain and updates the
+  // element count, trusting the caller to have verified that the table has
+  // spare capacity and does not already contain the key. Returns the index
+  // of the new entry; the caller fills in the payload slots itself.
+  int AddEntryRaw(int hash) {
+    DCHECK_LT(UsedCapacity(), Capacity());
+    int bucket = HashToBucket(hash);
+    int previous_entry = HashToEntryRaw(hash);
+    int nof = NumberOfElements();
+    int new_entry = nof + NumberOfDeletedElements();
+    int new_index = EntryToIndexRaw(new_entry);
+    set(new_index + kChainOffset, Smi::FromInt(previous_entry));
+    set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
+    SetNumberOfElements(nof + 1);
+    return new_index;
+  }
+
   // Returns an index into |this| for the given entry.
   int EntryToIndexRaw(int entry) {
     return HashTableStartIndex() + NumberOfBuckets() + (entry * kEntrySize);
@@ -275,6 +325,15 @@ class V8_EXPORT_PRIVATE OrderedHashSet
   static MaybeHandle<OrderedHashSet> Add(Isolate* isolate,
                                          Handle<OrderedHashSet> table,
                                          Handle<Object> value);
+  // Like the above, but for callers that already computed the value's identity
+  // hash, e.g. when bulk-populating the set from an array.
+  static MaybeHandle<OrderedHashSet> Add(Isolate* isolate,
+                                         Handle<OrderedHashSet> table,
+                                         Handle<Object> value, int hash);
+  // Raw insertion for bulk-populating a table that is known to have spare
+  // capacity and not to contain |value|, e.g. when migrating from the small
+  // representation. The caller must not allow GC while inserting.
+  void AddNoResize(Object value, int hash);
   static Handle<FixedArray> ConvertToKeysArray(Isolate* isolate,
                                                Handle<OrderedHashSet> table,
                                                GetKeysConversion convert);
@@ -313,6 +372,14 @@ class V8_EXPORT_PRIVATE OrderedHashMap
                                          Handle<OrderedHashMap> table,
                                          Handle<Object> key,
                                          Handle<Object> value);
+  // Like the above, but for callers that already computed the key's identity
+  // hash, e.g. when bulk-populating the map from an array.
+  static MaybeHandle<OrderedHashMap> Add(Isolate* isolate,
+                                         Handle<OrderedHashMap> table,
+                                         Handle<Object> key,
+                                         Handle<Object> value, int hash);
+  // Raw insertion counterpart of OrderedHashSet::AddNoResize; see there.
+  void AddNoResize(Object key, Object value, int hash);
 
   template <typename IsolateT>
   static MaybeHandle<OrderedHashMap> Allocate(
@@ -405,6 +472,12 @@ class SmallOrderedHashTable : public HeapObject {
 
   void Initialize(Isolate* isolate, int capacity);
 
+#ifdef DEBUG
+  // Verifies a freshly initialized table. Out of line so the verification
+  // loops do not bloat Initialize in debug builds.
+  V8_NOINLINE void CheckInitialized(Isolate* isolate, int capacity);
+#endif  // DEBUG
+
   static Handle<Derived> Allocate(
       Isolate* isolate, int capacity,
       AllocationType allocation = AllocationType::kYoung);
@@ -765,6 +838,9 @@ class V8_EXPORT_PRIVATE OrderedNameDictionary
       Isolate* isolate, Handle<OrderedNameDictionary> table, Handle<Name> key,
       Handle<Object> value, PropertyDetails details);
 
+  // Raw insertion counterpart of OrderedHashSet::AddNoResize; see there.
+  void AddNoResize(Name key, Object value, PropertyDetails details);
+
   void SetEntry(InternalIndex entry, Object key, Object value,
                 PropertyDetails details);
 